@@ -1059,6 +1059,7 @@ def declare_build_targets(platform, static_libraries, shared_libraries, executab
          # debug files
          'lib/debug/Stacktrace.cpp',
          # Logger files
+         'lib/log/BinaryLog.cpp', 
          'lib/log/ExceptionRecord.cpp', 
          'lib/log/Formatter.cpp',   
          'lib/log/Function.cpp', 
@@ -1067,6 +1068,7 @@ def declare_build_targets(platform, static_libraries, shared_libraries, executab
          'lib/log/LoggerImpl.cpp',  
          'lib/log/OutputHandler.cpp', 
          'lib/log/Record.cpp', 
+         'lib/log/RecordQueue.cpp', 
          # Unit test files
          'lib/unittest/TestRunner.cpp', 
          'lib/unittest/TestStdOutput.cpp'
@@ -1213,6 +1215,21 @@ def declare_build_targets(platform, static_libraries, shared_libraries, executab
       'libs': ['fmt', 'orion', 'orion-net']
    }
 
+   #------------------------------------------------------------------------------------------------
+   # Tools
+   # 
+
+   # Tool: orion-logdecode
+   #
+   executables['orion-logdecode'] = {
+      'tool'     : 'cxx',
+      'includes' : ['include', 'deps'],
+      'sources'  : [
+         'tools/orion-logdecode.cpp'
+      ],
+      'libs': ['fmt', 'orion']
+   }
+
    #------------------------------------------------------------------------------------------------
    # Examples
    # 
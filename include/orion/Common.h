@@ -14,6 +14,7 @@
 #include <exception>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 #ifndef NO_COPY
 #define NO_COPY(klass) \
@@ -79,24 +80,41 @@ inline constexpr void ignore_unused()
 #define DbgSrcLoc \
    SourceLocation{__FILE__, __LINE__}
 
+/// Location in the source code, usually built by DbgSrcLoc
+///
+/// The names are not copied, so building a location never allocates. They
+/// must outlive the location, as the __FILE__ and __func__ literals do.
+/// Names held by a std::string temporary are rejected at compile time; a
+/// location built from a runtime string must not outlive that string.
+///
 class SourceLocation
 {
+   template<typename S>
+   using if_temporary_string = std::enable_if_t<std::is_same_v<S, std::string>>;
+
 public:
-   SourceLocation() = default;
-   
-   SourceLocation(std::string_view fn, int ln);
-   SourceLocation(std::string_view fn, int ln, std::string_view fun);
+   constexpr SourceLocation() = default;
+
+   constexpr SourceLocation(std::string_view fn, int ln);
+   constexpr SourceLocation(std::string_view fn, int ln, std::string_view fun);
+
+   template<typename S, typename = if_temporary_string<S>>
+   SourceLocation(S&& fn, int ln) = delete;
+   template<typename S, typename = if_temporary_string<S>>
+   SourceLocation(S&& fn, int ln, std::string_view fun) = delete;
+   template<typename S, typename = if_temporary_string<S>>
+   SourceLocation(std::string_view fn, int ln, S&& fun) = delete;
 
-   const std::string& file_name() const;
+   constexpr std::string_view file_name() const;
 
    constexpr int line_number() const;
 
-   const std::string& function_name() const;
+   constexpr std::string_view function_name() const;
 
 private:
-   std::string _file_name{"(unknown)"};
+   std::string_view _file_name{"(unknown)"};
    int _line_number{0};
-   std::string _function_name{"(unknown)"};
+   std::string_view _function_name{"(unknown)"};
 };
 
 //-------------------------------------------------------------------------------------------------
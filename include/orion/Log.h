@@ -8,6 +8,7 @@
 #ifndef ORION_LOG_H
 #define ORION_LOG_H
 
+#include <orion/log/BinaryLog.h>
 #include <orion/log/Formatter.h>
 #include <orion/log/Function.h>
 #include <orion/log/Level.h>
@@ -15,5 +16,6 @@
 #include <orion/log/Macros.h>
 #include <orion/log/OutputHandler.h>
 #include <orion/log/Record.h>
+#include <orion/log/RecordQueue.h>
 
 #endif
@@ -13,20 +13,20 @@
 namespace orion
 {
 
-inline SourceLocation::SourceLocation(std::string_view fn, int ln)
-   : _file_name(fn.begin(), fn.end())
+inline constexpr SourceLocation::SourceLocation(std::string_view fn, int ln)
+   : _file_name(fn)
    , _line_number(ln)
 {
 }
 
-inline SourceLocation::SourceLocation(std::string_view fn, int ln, std::string_view fun)
-   : _file_name(fn.begin(), fn.end())
+inline constexpr SourceLocation::SourceLocation(std::string_view fn, int ln, std::string_view fun)
+   : _file_name(fn)
    , _line_number(ln)
-   , _function_name(fun.begin(), fun.end())
+   , _function_name(fun)
 {
 }
 
-inline const std::string& SourceLocation::file_name() const
+inline constexpr std::string_view SourceLocation::file_name() const
 {
    return _file_name;
 }
@@ -36,7 +36,7 @@ inline constexpr int SourceLocation::line_number() const
    return _line_number;
 }
 
-inline const std::string& SourceLocation::function_name() const
+inline constexpr std::string_view SourceLocation::function_name() const
 {
    return _function_name;
 }
@@ -12,10 +12,12 @@
 
 #include <orion/log/Level.h>
 #include <orion/log/OutputHandler.h>
+#include <orion/log/RecordQueue.h>
 
 #include <asio.hpp>
 
 #include <functional>
+#include <vector>
 
 namespace orion
 {
@@ -110,6 +112,31 @@ public:
    /// Writes a log record with a specified logging level
    void write(const Record& record);
 
+   /// Writes a log record, from the worker thread when logging asynchronously
+   void write(Record&& record);
+
+   /// Decodes and writes a buffer of binary records from the worker thread
+   void write_binary(std::vector<char>&& records);
+
+   /// Writes the queued records and flushes the output handlers
+   void flush();
+
+   /// Queue the records and write them from the logger worker thread.
+   ///
+   /// @param capacity Maximum number of queued records
+   /// @param policy   What to do when the queue is full
+   ///
+   void enable_async(std::size_t capacity, OverflowPolicy policy = OverflowPolicy::Block);
+
+   /// Writes the queued records and goes back to writing on the calling thread.
+   void disable_async();
+
+   /// Indicates if records are written from the logger worker thread
+   bool is_async() const;
+
+   /// Number of records discarded because the queue was full
+   uint64_t dropped_count() const;
+
    /// Starts the logging
    void start(SystemInfoFunc system_info);
 
@@ -130,6 +157,8 @@ public:
    /// Log a character
    BasicLogger& operator+=(const Record& record);
 
+   BasicLogger& operator+=(Record&& record);
+
 private:
    /// The backend service implementation.
    ServiceType& _service;
@@ -0,0 +1,300 @@
+//
+// BinaryLog.h
+//
+// Copyright (c) 2013-2017 Tomas Palazuelos
+//
+// Distributed under the MIT Software License. (See accompanying file LICENSE.md)
+//
+#ifndef ORION_LOG_BINARYLOG_H
+#define ORION_LOG_BINARYLOG_H
+
+#include <orion/Common.h>
+
+#include <orion/log/Level.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace orion
+{
+namespace log
+{
+class Record;
+
+/// Deferred binary logging
+///
+/// A call site logged with LOG_DEFERRED only serializes its call site id,
+/// a time stamp and the raw bytes of its arguments into a per-thread buffer.
+/// Full buffers are handed to a BinaryOutput which either writes them to a
+/// file, to be decoded later by orion-logdecode, or passes them to the logger
+/// worker thread that formats them with the output handlers.
+///
+/// The data is stored in the native byte order of the machine that wrote it.
+///
+/// File layout:
+///   - Magic "ORBL" followed by a uint32 version.
+///   - Blocks: uint8 kind, uint32 length and the block data.
+///     - CallSite block: uint32 id, uint16 level, int32 line, uint32 length, file name.
+///     - Records block: sequence of records.
+///   - Record: uint32 call site id, int64 time stamp (ns), uint8 argument count, arguments.
+///   - Argument: uint8 ArgType followed by the value. Strings are prefixed by a uint32 length.
+///
+
+/// Type of an encoded argument
+enum class ArgType : uint8_t
+{
+   Int    = 1,
+   UInt   = 2,
+   Double = 3,
+   Bool   = 4,
+   Char   = 5,
+   String = 6
+};
+
+/// Type of a block in a binary log file
+enum class BlockKind : uint8_t
+{
+   CallSite = 1,
+   Records  = 2
+};
+
+/// Static description of a deferred log call site
+struct CallSite
+{
+   Level level;
+   const char* file_name;
+   int line_number;
+};
+
+/// Registers a call site and returns its id
+API_EXPORT uint32_t register_call_site(const CallSite& site);
+
+/// Returns the registered call sites, indexed by id
+API_EXPORT std::vector<CallSite> registered_call_sites();
+
+//--------------------------------------------------------------------------------------------------
+// Class BinaryOutput
+
+/// Destination of the binary log buffers
+class API_EXPORT BinaryOutput
+{
+public:
+   virtual ~BinaryOutput() = default;
+
+   /// Writes a buffer of encoded records
+   virtual void write(std::vector<char>&& records) = 0;
+};
+
+/// Sets the destination of the binary log buffers. Buffers are discarded without one.
+API_EXPORT void set_binary_output(std::shared_ptr<BinaryOutput> output);
+
+/// Hands the buffered records of every thread to the binary output
+API_EXPORT void flush_binary();
+
+//--------------------------------------------------------------------------------------------------
+// Class BinaryStreamOutput
+
+/// Writes the binary log to a stream
+///
+/// The stream must be opened in binary mode. The call sites are written
+/// before the first records that use them.
+///
+class API_EXPORT BinaryStreamOutput : public BinaryOutput
+{
+public:
+   NO_COPY(BinaryStreamOutput)
+   NO_MOVE(BinaryStreamOutput)
+
+   explicit BinaryStreamOutput(std::ostream& stream);
+   ~BinaryStreamOutput() override;
+
+   void write(std::vector<char>&& records) override;
+
+private:
+   std::ostream& _ostream;
+   std::size_t _sites_written;
+   std::mutex _mutex;
+};
+
+API_EXPORT std::shared_ptr<BinaryStreamOutput> make_binary_stream_output(std::ostream& stream);
+
+//--------------------------------------------------------------------------------------------------
+// Class BinaryLoggerOutput
+
+/// Formats the binary log on the logger worker thread with the output handlers
+class API_EXPORT BinaryLoggerOutput : public BinaryOutput
+{
+public:
+   void write(std::vector<char>&& records) override;
+};
+
+API_EXPORT std::shared_ptr<BinaryLoggerOutput> make_binary_logger_output();
+
+//--------------------------------------------------------------------------------------------------
+// Class BinaryDecoder
+
+/// Turns binary log data back into records
+class API_EXPORT BinaryDecoder
+{
+public:
+   using RecordFunc = std::function<void(Record&&)>;
+
+   explicit BinaryDecoder(RecordFunc func);
+
+   /// Adds the call sites registered in this process
+   void add_registered_call_sites();
+
+   /// Adds the description of a call site
+   void add_call_site(uint32_t id, Level level, std::string_view file_name, int line_number);
+
+   /// Decodes a buffer of records. Returns false if the data is malformed.
+   ///
+   /// The source locations of the records refer to the call sites of the
+   /// decoder. Adding sites never moves the known ones, so the locations are
+   /// valid while the decoder is, unless their call site id is redefined.
+   bool decode_records(const char* data, std::size_t size);
+
+   /// Decodes a binary log file. Returns false if the data is malformed.
+   bool decode(std::istream& in);
+
+private:
+   struct Site
+   {
+      Level level{Level::NotSet};
+      std::string file_name;
+      int line_number{0};
+   };
+
+   RecordFunc _func;
+   // A deque, so growing it never moves the names the records refer to
+   std::deque<Site> _sites;
+};
+
+//--------------------------------------------------------------------------------------------------
+
+namespace detail
+{
+/// Buffer of encoded records of a thread
+///
+/// The owner thread appends to it under the lock, which is only contended
+/// while flush_binary() drains the buffers of all the threads.
+///
+struct API_EXPORT BinaryBuffer
+{
+   NO_COPY(BinaryBuffer)
+   NO_MOVE(BinaryBuffer)
+
+   BinaryBuffer();
+   ~BinaryBuffer();
+
+   std::mutex mutex;
+   std::vector<char> data;
+};
+
+/// Buffer of encoded records of the calling thread
+API_EXPORT BinaryBuffer& binary_buffer();
+
+/// Hands the buffer to the binary output when it is full
+API_EXPORT void commit_binary_buffer(std::vector<char>& buffer);
+
+inline void put_bytes(std::vector<char>& buffer, const void* data, std::size_t size)
+{
+   auto pos = buffer.size();
+
+   buffer.resize(pos + size);
+   std::memcpy(buffer.data() + pos, data, size);
+}
+
+template<typename T>
+void put(std::vector<char>& buffer, const T& value)
+{
+   put_bytes(buffer, &value, sizeof(T));
+}
+
+inline void put_string(std::vector<char>& buffer, std::string_view text)
+{
+   put(buffer, ArgType::String);
+   put(buffer, static_cast<uint32_t>(text.size()));
+   put_bytes(buffer, text.data(), text.size());
+}
+
+template<typename T>
+void encode_arg(std::vector<char>& buffer, const T& value)
+{
+   if constexpr (std::is_same_v<T, bool>)
+   {
+      put(buffer, ArgType::Bool);
+      put(buffer, static_cast<uint8_t>(value));
+   }
+   else if constexpr (std::is_same_v<T, char>)
+   {
+      put(buffer, ArgType::Char);
+      put(buffer, value);
+   }
+   else if constexpr (std::is_floating_point_v<T>)
+   {
+      put(buffer, ArgType::Double);
+      put(buffer, static_cast<double>(value));
+   }
+   else if constexpr (std::is_integral_v<T> and std::is_signed_v<T>)
+   {
+      put(buffer, ArgType::Int);
+      put(buffer, static_cast<int64_t>(value));
+   }
+   else if constexpr (std::is_integral_v<T>)
+   {
+      put(buffer, ArgType::UInt);
+      put(buffer, static_cast<uint64_t>(value));
+   }
+   else if constexpr (std::is_convertible_v<const T&, std::string_view>)
+   {
+      put_string(buffer, value);
+   }
+   else
+   {
+      // Types only printable through a stream are formatted at the call site
+      std::ostringstream stream;
+      stream << value;
+      put_string(buffer, stream.str());
+   }
+}
+} // namespace detail
+
+/// Encodes a record of a registered call site into the buffer of the calling thread
+template<typename... Args>
+void write_binary(uint32_t site_id, const Args&... args)
+{
+   static_assert(sizeof...(Args) < 256, "Too many arguments");
+
+   auto now = std::chrono::system_clock::now().time_since_epoch();
+
+   auto& thread_buffer = detail::binary_buffer();
+
+   std::lock_guard<std::mutex> lock(thread_buffer.mutex);
+
+   auto& buffer = thread_buffer.data;
+
+   detail::put(buffer, site_id);
+   detail::put(buffer, static_cast<int64_t>(std::chrono::nanoseconds(now).count()));
+   detail::put(buffer, static_cast<uint8_t>(sizeof...(Args)));
+
+   (detail::encode_arg(buffer, args), ...);
+
+   detail::commit_binary_buffer(buffer);
+}
+
+} // namespace log
+} // namespace orion
+
+#endif /* ORION_LOG_BINARYLOG_H */
@@ -22,7 +22,7 @@ class API_EXPORT ExceptionRecord : public Record
 public:
    NO_COPY(ExceptionRecord)
 
-   ExceptionRecord(const std::string& msg,
+   ExceptionRecord(std::string_view msg,
                    const SourceLocation& thrown_src_loc,
                    const SourceLocation& caught_src_loc);
 
@@ -32,6 +32,8 @@ public:
 
    ExceptionRecord& operator=(ExceptionRecord&& rhs) noexcept;
 
+   std::unique_ptr<Record> detach() override;
+
    /// Returns the source location recorded when the exception is thrown
    const SourceLocation& thrown_source_location() const;
 
@@ -10,12 +10,17 @@
 
 #include <orion/Common.h>
 
+#include <orion/log/BinaryLog.h>
 #include <orion/log/OutputHandler.h>
 #include <orion/log/Record.h>
+#include <orion/log/RecordQueue.h>
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <vector>
 
 namespace orion
 {
@@ -52,6 +57,36 @@ public:
    /// Write a record to the output handlers
    void write(const Record& record);
 
+   /// Queues the record when logging asynchronously, otherwise writes it.
+   ///
+   /// Returns true if the caller must schedule a call to drain().
+   bool enqueue(Record&& record);
+
+   /// Queues a buffer of binary records to be decoded by drain().
+   ///
+   /// Returns true if the caller must schedule a call to drain().
+   bool enqueue_binary(std::vector<char>&& records);
+
+   /// Writes all queued records to the output handlers
+   void drain();
+
+   /// Writes all queued records and flushes the output handlers
+   void flush();
+
+   /// Queue the records and write them from the logger worker thread.
+   ///
+   /// Must be called before records are written from several threads.
+   void enable_async(std::size_t capacity, OverflowPolicy policy);
+
+   /// Writes the queued records and goes back to writing on the calling thread.
+   void disable_async();
+
+   /// Indicates if records are written from the logger worker thread
+   bool is_async() const;
+
+   /// Number of records discarded because the queue was full
+   uint64_t dropped_count() const;
+
    /// Starts the logging
    void start(const SystemInfoFunc& system_info);
 
@@ -70,11 +105,34 @@ public:
    uint32_t scope_depth() const;
 
 private:
+   void write_unlocked(const Record& record);
+   void drain_unlocked();
+
    OutputHandlers _output_handlers;
 
    Level _level;
    bool _is_running;
    uint32_t _scope_depth;
+
+   /// Serializes the calls to the output handlers
+   std::mutex _write_mutex;
+
+   /// Queue of the records written asynchronously
+   std::atomic<RecordQueue*> _queue;
+
+   /// Every queue created by enable_async(). A replaced queue is kept, as a
+   /// writer may still be pushing to it, and drained with the current one.
+   mutable std::mutex _queues_mutex;
+   std::vector<std::unique_ptr<RecordQueue>> _queues;
+
+   std::atomic<bool> _is_async;
+   std::atomic<bool> _drain_pending;
+
+   /// Buffers of binary records waiting to be decoded
+   std::mutex _binary_mutex;
+   std::vector<std::vector<char>> _binary_records;
+
+   BinaryDecoder _binary_decoder;
 };
 
 } // namespace log
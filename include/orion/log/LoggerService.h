@@ -10,9 +10,12 @@
 
 #include <orion/Config.h>
 
+#include <orion/log/RecordQueue.h>
+
 #include <asio.hpp>
 
 #include <string>
+#include <vector>
 
 namespace orion
 {
@@ -80,6 +83,36 @@ public:
    /// Write a record to the output handlers
    void write(ImplType& impl, const Record& record) { impl->write(record); }
 
+   /// Write a record to the output handlers, from the worker thread when asynchronous
+   void write(ImplType& impl, Record&& record)
+   {
+      if (impl->enqueue(std::move(record)))
+         asio::post(_work_io_context, [impl]() { impl->drain(); });
+   }
+
+   /// Decode and write binary records from the worker thread
+   void write_binary(ImplType& impl, std::vector<char>&& records)
+   {
+      if (impl->enqueue_binary(std::move(records)))
+         asio::post(_work_io_context, [impl]() { impl->drain(); });
+   }
+
+   /// Writes the queued records and flushes the output handlers
+   void flush(ImplType& impl) { impl->flush(); }
+
+   /// Queue the records and write them from the worker thread
+   void enable_async(ImplType& impl, std::size_t capacity, OverflowPolicy policy)
+   {
+      impl->enable_async(capacity, policy);
+   }
+
+   /// Write the records on the calling thread
+   void disable_async(ImplType& impl) { impl->disable_async(); }
+
+   bool is_async(const ImplType& impl) const { return impl->is_async(); }
+
+   uint64_t dropped_count(const ImplType& impl) const { return impl->dropped_count(); }
+
    /// Starts the logging
    void start(ImplType& impl, SystemInfoFunc system_info) { impl->start(system_info); }
 
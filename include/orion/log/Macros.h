@@ -15,6 +15,17 @@ if(orion::log::default_logger().is_enabled(orion::log::Level::lvl)) \
       orion::log::default_logger() += orion::log::Record(orion::log::Level::lvl, "", DbgSrcLoc)
 #endif
 
+#ifndef LOG_DEFERRED
+#define LOG_DEFERRED(lvl, ...)                                                        \
+   do                                                                                 \
+   {                                                                                  \
+      static const uint32_t _log_site_id = orion::log::register_call_site(            \
+         orion::log::CallSite{orion::log::Level::lvl, __FILE__, __LINE__});           \
+      if (orion::log::default_logger().is_enabled(orion::log::Level::lvl))            \
+         orion::log::write_binary(_log_site_id, __VA_ARGS__);                         \
+   } while (0)
+#endif
+
 #ifndef LOG_FUNCTION
 #define LOG_FUNCTION(lvl, func_name)                  \
    \
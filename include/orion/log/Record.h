@@ -13,7 +13,13 @@
 #include <orion/Chrono.h>
 #include <orion/log/Level.h>
 
+#include <fmt/format.h>
+
+#include <iterator>
+#include <memory>
 #include <sstream>
+#include <string_view>
+#include <type_traits>
 
 namespace orion
 {
@@ -28,16 +34,24 @@ namespace log
 /// the jog of th Formatter to format the Records information that
 /// will be saved by the OutputHandler.
 ///
+/// The message is kept in an inline buffer. Only messages longer than
+/// Record::inline_size bytes allocate memory.
+///
 class API_EXPORT Record
 {
 public:
    NO_COPY(Record)
-   
+
+   /// Number of message bytes stored without allocating
+   static constexpr std::size_t inline_size = 256;
+
+   using MessageBuffer = fmt::basic_memory_buffer<char, inline_size>;
+
    Record();
 
-   Record(Level level, const std::string& msg);
+   Record(Level level, std::string_view msg);
 
-   Record(Level level, const std::string& msg, const SourceLocation& src_loc);
+   Record(Level level, std::string_view msg, const SourceLocation& src_loc);
 
    Record(Record&& rhs) noexcept;
 
@@ -52,14 +66,23 @@ public:
    /// Returns the time stamp of the log record
    TimePoint<> time_stamp() const;
 
+   /// Records the time stamp of the log record
+   void time_stamp(TimePoint<> value);
+
    /// Returns the message recorded
-   virtual std::string message() const;
+   ///
+   /// The view is valid until the record is modified or destroyed.
+   std::string_view message() const;
 
    /// Records a message
-   virtual void message(const std::string& msg);
+   void message(std::string_view msg);
 
    /// Appends some text to the message
-   virtual void append_message(const std::string& text);
+   void append_message(std::string_view text);
+
+   /// Appends a value to the message
+   template<typename T>
+   void append(const T& value);
 
    /// Returns the source location recorded
    const SourceLocation& source_location() const;
@@ -67,15 +90,23 @@ public:
    /// Records source location
    void source_location(const SourceLocation& value);
 
+   /// Moves the record into a heap allocated record of the same type
+   ///
+   /// Used to hand the record over to the logger worker thread.
+   virtual std::unique_ptr<Record> detach();
+
    Record& operator=(Record&& rhs) noexcept;
 
    template<typename T>
-   Record& operator<<(const T& value);
+   Record& operator<<(const T& value) &;
+
+   template<typename T>
+   Record&& operator<<(const T& value) &&;
 
 private:
    Level _level;
    TimePoint<> _time_stamp;
-   std::ostringstream _message;
+   MessageBuffer _message;
 
    SourceLocation _src_location;
 };
@@ -83,12 +114,39 @@ private:
 //-------------------------------------------------------------------------------------------------
 
 template<typename T>
-Record& Record::operator<<(const T& value)
+void Record::append(const T& value)
+{
+   if constexpr (std::is_convertible_v<const T&, std::string_view>)
+   {
+      append_message(value);
+   }
+   else if constexpr (std::is_arithmetic_v<T> and not std::is_same_v<T, bool>)
+   {
+      fmt::format_to(std::back_inserter(_message), "{}", value);
+   }
+   else
+   {
+      // Types only printable through a stream
+      std::ostringstream stream;
+      stream << value;
+      append_message(stream.str());
+   }
+}
+
+template<typename T>
+Record& Record::operator<<(const T& value) &
 {
-   _message << value;
+   append(value);
    return *this;
 }
 
+template<typename T>
+Record&& Record::operator<<(const T& value) &&
+{
+   append(value);
+   return std::move(*this);
+}
+
 } // namespace log
 } // namespace orion
 
@@ -0,0 +1,92 @@
+//
+// RecordQueue.h
+//
+// Copyright (c) 2013-2017 Tomas Palazuelos
+//
+// Distributed under the MIT Software License. (See accompanying file LICENSE.md)
+//
+#ifndef ORION_LOG_RECORDQUEUE_H
+#define ORION_LOG_RECORDQUEUE_H
+
+#include <orion/Common.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace orion
+{
+namespace log
+{
+class Record;
+
+/// What to do when a record is written and the queue is full
+enum class OverflowPolicy
+{
+   Block,      ///< Wait until the worker thread frees a slot, see RecordQueue::push()
+   DropNewest, ///< Discard the record being written
+   DropOldest  ///< Discard the oldest queued record to make room
+};
+
+/// Bounded lock-free record queue
+///
+/// Ring buffer of records shared by the threads writing to the logger and
+/// the logger worker thread. Each slot carries a sequence number so producers
+/// and the consumer can claim slots with a single compare and swap.
+///
+class API_EXPORT RecordQueue
+{
+public:
+   NO_COPY(RecordQueue)
+   NO_MOVE(RecordQueue)
+
+   /// Constructor
+   ///
+   /// @param capacity Number of slots, rounded up to the next power of two
+   /// @param policy   What to do when the queue is full
+   ///
+   RecordQueue(std::size_t capacity, OverflowPolicy policy);
+   ~RecordQueue();
+
+   /// Returns the number of slots in the queue
+   std::size_t capacity() const;
+
+   /// Returns the overflow policy
+   OverflowPolicy policy() const;
+
+   /// Returns the number of records discarded because the queue was full
+   uint64_t dropped_count() const;
+
+   /// Adds a record to the queue. Returns false if the record was dropped.
+   ///
+   /// With the Block policy, a thread that cannot wait drops the record when
+   /// the queue is full, e.g. the thread emptying the queue, which would
+   /// otherwise wait for itself.
+   bool push(std::unique_ptr<Record>&& record, bool can_wait = true);
+
+   /// Removes the oldest record from the queue. Returns null if the queue is empty.
+   std::unique_ptr<Record> pop();
+
+private:
+   bool try_push(std::unique_ptr<Record>& record);
+
+   struct Cell
+   {
+      std::atomic<std::size_t> sequence;
+      std::unique_ptr<Record> record;
+   };
+
+   std::unique_ptr<Cell[]> _cells;
+   std::size_t _mask;
+   OverflowPolicy _policy;
+
+   std::atomic<uint64_t> _dropped_count;
+
+   alignas(64) std::atomic<std::size_t> _enqueue_pos;
+   alignas(64) std::atomic<std::size_t> _dequeue_pos;
+};
+
+} // namespace log
+} // namespace orion
+
+#endif /* ORION_LOG_RECORDQUEUE_H */
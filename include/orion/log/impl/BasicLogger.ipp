@@ -12,8 +12,7 @@
 
 #include <orion/TypeTraits.h>
 #include <orion/log/ExceptionRecord.h>
-
-#include <sstream>
+#include <orion/log/Record.h>
 
 namespace orion
 {
@@ -24,17 +23,17 @@ namespace detail
 {
 struct Concatenate
 {
-   std::ostringstream& buffer;
+   Record& record;
 
    template<typename T>
    void operator()(T& value)
    {
-      buffer << value;
+      record << value;
    }
 
    void operator()(std::error_code& ec) 
    {
-      buffer << ec.category().name() 
+      record << ec.category().name() 
              << ": (Code " 
              << ec.value()
              << ") "
@@ -43,7 +42,7 @@ struct Concatenate
 
    void operator()(const std::error_code& ec) 
    {
-      buffer << ec.category().name() 
+      record << ec.category().name() 
              << ": (Code " 
              << ec.value()
              << ") "
@@ -52,7 +51,7 @@ struct Concatenate
 
    void operator()(const std::exception& e) 
    {
-      buffer << e.what(); 
+      record << e.what(); 
    }
 
    void operator()(SourceLocation& /*unused*/) {}
@@ -124,13 +123,13 @@ void BasicLogger<Service>::exception(const std::exception& e, Args&&... args)
 {
    auto t = std::make_tuple(args...);
 
-   std::ostringstream buffer(e.what(), std::ios_base::ate);
+   auto sl = get_value<SourceLocation>(t, SourceLocation{});
 
-   get_all_values(detail::Concatenate{buffer}, t);
+   ExceptionRecord record{e.what(), SourceLocation{}, sl};
 
-   auto sl = get_value<SourceLocation>(t, SourceLocation{});
+   get_all_values(detail::Concatenate{record}, t);
 
-   _service.write(_impl, ExceptionRecord{buffer.str(), SourceLocation{}, sl});
+   _service.write(_impl, std::move(record));
 }
 
 template<typename Service>
@@ -139,13 +138,13 @@ void BasicLogger<Service>::exception(const orion::Exception& e, Args&&... args)
 {
    auto t = std::make_tuple(args...);
 
-   std::ostringstream buffer(e.what(), std::ios_base::ate);
+   auto sl = get_value<SourceLocation>(t, SourceLocation{});
 
-   get_all_values(detail::Concatenate{buffer}, t);
+   ExceptionRecord record{e.what(), e.source_location(), sl};
 
-   auto sl = get_value<SourceLocation>(t, SourceLocation{});
+   get_all_values(detail::Concatenate{record}, t);
 
-   _service.write(_impl, ExceptionRecord{buffer.str(), e.source_location(), sl});
+   _service.write(_impl, std::move(record));
 }
 
 template<typename Service>
@@ -162,13 +161,13 @@ void BasicLogger<Service>::write(Level level, Args&&... args)
 {
    auto t = std::forward_as_tuple(args...);
 
-   std::ostringstream buffer;
+   auto sl = get_value<SourceLocation>(t, SourceLocation{});
 
-   get_all_values(detail::Concatenate{buffer}, t);
+   Record record{level, "", sl};
 
-   auto sl = get_value<SourceLocation>(t, SourceLocation{});
+   get_all_values(detail::Concatenate{record}, t);
 
-   _service.write(_impl, Record{level, buffer.str(), sl});
+   _service.write(_impl, std::move(record));
 }
 
 template<typename Service>
@@ -177,6 +176,48 @@ void BasicLogger<Service>::write(const Record& record)
    _service.write(_impl, record);
 }
 
+template<typename Service>
+void BasicLogger<Service>::write(Record&& record)
+{
+   _service.write(_impl, std::move(record));
+}
+
+template<typename Service>
+void BasicLogger<Service>::write_binary(std::vector<char>&& records)
+{
+   _service.write_binary(_impl, std::move(records));
+}
+
+template<typename Service>
+void BasicLogger<Service>::flush()
+{
+   _service.flush(_impl);
+}
+
+template<typename Service>
+void BasicLogger<Service>::enable_async(std::size_t capacity, OverflowPolicy policy)
+{
+   _service.enable_async(_impl, capacity, policy);
+}
+
+template<typename Service>
+void BasicLogger<Service>::disable_async()
+{
+   _service.disable_async(_impl);
+}
+
+template<typename Service>
+bool BasicLogger<Service>::is_async() const
+{
+   return _service.is_async(_impl);
+}
+
+template<typename Service>
+uint64_t BasicLogger<Service>::dropped_count() const
+{
+   return _service.dropped_count(_impl);
+}
+
 template<typename Service>
 void BasicLogger<Service>::start(SystemInfoFunc system_info)
 {
@@ -226,6 +267,13 @@ BasicLogger<Service>& BasicLogger<Service>::operator+=(const Record& record)
    return *this;
 }
 
+template<typename Service>
+BasicLogger<Service>& BasicLogger<Service>::operator+=(Record&& record)
+{
+   _service.write(_impl, std::move(record));
+   return *this;
+}
+
 } // namespace log
 } // namespace orion
 
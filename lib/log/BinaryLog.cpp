@@ -0,0 +1,485 @@
+//
+// BinaryLog.cpp
+//
+// Copyright (c) 2013-2017 Tomas Palazuelos
+//
+// Distributed under the MIT Software License. (See accompanying file LICENSE.md)
+//
+#include <orion/log/BinaryLog.h>
+
+#include <orion/log/Logger.h>
+#include <orion/log/Record.h>
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+namespace orion
+{
+namespace log
+{
+namespace
+{
+constexpr char magic[4]      = {'O', 'R', 'B', 'L'};
+constexpr uint32_t version   = 1;
+constexpr std::size_t commit_size = 16 * 1024;
+
+struct CallSiteRegistry
+{
+   std::mutex mutex;
+   std::vector<CallSite> sites;
+};
+
+CallSiteRegistry& call_site_registry()
+{
+   static CallSiteRegistry registry;
+   return registry;
+}
+
+/// Copies the call sites registered from index first on
+std::vector<CallSite> call_sites_from(std::size_t first)
+{
+   auto& registry = call_site_registry();
+
+   std::lock_guard<std::mutex> lock(registry.mutex);
+
+   if (first >= registry.sites.size())
+      return {};
+
+   return std::vector<CallSite>(registry.sites.begin() + first, registry.sites.end());
+}
+
+struct BinaryOutputHolder
+{
+   std::mutex mutex;
+   std::shared_ptr<BinaryOutput> output;
+};
+
+BinaryOutputHolder& binary_output_holder()
+{
+   static BinaryOutputHolder holder;
+   return holder;
+}
+
+std::shared_ptr<BinaryOutput> binary_output()
+{
+   auto& holder = binary_output_holder();
+
+   std::lock_guard<std::mutex> lock(holder.mutex);
+   return holder.output;
+}
+
+void submit(std::vector<char>& buffer)
+{
+   auto output = binary_output();
+
+   if (output != nullptr)
+      output->write(std::move(buffer));
+
+   buffer.clear();
+   buffer.reserve(commit_size + 256);
+}
+
+/// Buffers of the running threads, so they can all be flushed
+struct BinaryBufferRegistry
+{
+   std::mutex mutex;
+   std::vector<detail::BinaryBuffer*> buffers;
+};
+
+BinaryBufferRegistry& binary_buffer_registry()
+{
+   static BinaryBufferRegistry registry;
+   return registry;
+}
+
+/// Bounds checked reader of encoded data
+class Reader
+{
+public:
+   Reader(const char* data, std::size_t size)
+      : _pos(data)
+      , _end(data + size)
+   {
+   }
+
+   bool at_end() const { return _pos == _end; }
+
+   template<typename T>
+   bool read(T& value)
+   {
+      if (static_cast<std::size_t>(_end - _pos) < sizeof(T))
+         return false;
+
+      std::memcpy(&value, _pos, sizeof(T));
+      _pos += sizeof(T);
+      return true;
+   }
+
+   bool read(std::string_view& text)
+   {
+      uint32_t len = 0;
+
+      if (not read(len) or static_cast<std::size_t>(_end - _pos) < len)
+         return false;
+
+      text = std::string_view(_pos, len);
+      _pos += len;
+      return true;
+   }
+
+private:
+   const char* _pos;
+   const char* _end;
+};
+
+bool decode_arg(Reader& reader, Record& record)
+{
+   ArgType type{};
+
+   if (not reader.read(type))
+      return false;
+
+   switch (type)
+   {
+      case ArgType::Int:
+      {
+         int64_t value = 0;
+         if (not reader.read(value))
+            return false;
+         record << value;
+         return true;
+      }
+      case ArgType::UInt:
+      {
+         uint64_t value = 0;
+         if (not reader.read(value))
+            return false;
+         record << value;
+         return true;
+      }
+      case ArgType::Double:
+      {
+         double value = 0.0;
+         if (not reader.read(value))
+            return false;
+         record << value;
+         return true;
+      }
+      case ArgType::Bool:
+      {
+         uint8_t value = 0;
+         if (not reader.read(value))
+            return false;
+         record << (value != 0);
+         return true;
+      }
+      case ArgType::Char:
+      {
+         char value = 0;
+         if (not reader.read(value))
+            return false;
+         record << value;
+         return true;
+      }
+      case ArgType::String:
+      {
+         std::string_view value;
+         if (not reader.read(value))
+            return false;
+         record.append_message(value);
+         return true;
+      }
+   }
+   return false;
+}
+
+template<typename T>
+void write_value(std::ostream& out, const T& value)
+{
+   out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool read_value(std::istream& in, T& value)
+{
+   return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+} // namespace
+
+//--------------------------------------------------------------------------------------------------
+
+uint32_t register_call_site(const CallSite& site)
+{
+   auto& registry = call_site_registry();
+
+   std::lock_guard<std::mutex> lock(registry.mutex);
+
+   registry.sites.push_back(site);
+   return static_cast<uint32_t>(registry.sites.size() - 1);
+}
+
+std::vector<CallSite> registered_call_sites()
+{
+   auto& registry = call_site_registry();
+
+   std::lock_guard<std::mutex> lock(registry.mutex);
+   return registry.sites;
+}
+
+void set_binary_output(std::shared_ptr<BinaryOutput> output)
+{
+   auto& holder = binary_output_holder();
+
+   std::lock_guard<std::mutex> lock(holder.mutex);
+   holder.output = std::move(output);
+}
+
+void flush_binary()
+{
+   auto& registry = binary_buffer_registry();
+
+   std::lock_guard<std::mutex> registry_lock(registry.mutex);
+
+   for (auto buffer : registry.buffers)
+   {
+      std::lock_guard<std::mutex> lock(buffer->mutex);
+
+      if (not buffer->data.empty())
+         submit(buffer->data);
+   }
+}
+
+namespace detail
+{
+BinaryBuffer::BinaryBuffer()
+   : mutex()
+   , data()
+{
+   data.reserve(commit_size + 256);
+
+   auto& registry = binary_buffer_registry();
+
+   std::lock_guard<std::mutex> lock(registry.mutex);
+   registry.buffers.push_back(this);
+}
+
+BinaryBuffer::~BinaryBuffer()
+{
+   auto& registry = binary_buffer_registry();
+   {
+      std::lock_guard<std::mutex> lock(registry.mutex);
+
+      auto it = std::find(registry.buffers.begin(), registry.buffers.end(), this);
+      if (it != registry.buffers.end())
+         registry.buffers.erase(it);
+   }
+
+   // Hands the remaining records to the output when the thread exits
+   if (not data.empty())
+      submit(data);
+}
+
+BinaryBuffer& binary_buffer()
+{
+   static thread_local BinaryBuffer buffer;
+   return buffer;
+}
+
+void commit_binary_buffer(std::vector<char>& buffer)
+{
+   if (buffer.size() >= commit_size)
+      submit(buffer);
+}
+} // namespace detail
+
+//--------------------------------------------------------------------------------------------------
+// Class BinaryStreamOutput
+
+BinaryStreamOutput::BinaryStreamOutput(std::ostream& stream)
+   : _ostream(stream)
+   , _sites_written(0)
+{
+   _ostream.write(magic, sizeof(magic));
+   write_value(_ostream, version);
+}
+
+BinaryStreamOutput::~BinaryStreamOutput()
+{
+   _ostream.flush();
+}
+
+void BinaryStreamOutput::write(std::vector<char>&& records)
+{
+   std::lock_guard<std::mutex> lock(_mutex);
+
+   // Describe the call sites registered since the last write
+   for (const auto& site : call_sites_from(_sites_written))
+   {
+
+      auto file_len = static_cast<uint32_t>(std::strlen(site.file_name));
+      auto len      = static_cast<uint32_t>(sizeof(uint32_t) + sizeof(uint16_t) + sizeof(int32_t) +
+                                       sizeof(uint32_t) + file_len);
+
+      write_value(_ostream, BlockKind::CallSite);
+      write_value(_ostream, len);
+      write_value(_ostream, static_cast<uint32_t>(_sites_written));
+      write_value(_ostream, static_cast<uint16_t>(site.level));
+      write_value(_ostream, static_cast<int32_t>(site.line_number));
+      write_value(_ostream, file_len);
+      _ostream.write(site.file_name, file_len);
+
+      ++_sites_written;
+   }
+
+   write_value(_ostream, BlockKind::Records);
+   write_value(_ostream, static_cast<uint32_t>(records.size()));
+   _ostream.write(records.data(), static_cast<std::streamsize>(records.size()));
+}
+
+std::shared_ptr<BinaryStreamOutput> make_binary_stream_output(std::ostream& stream)
+{
+   return std::make_shared<BinaryStreamOutput>(stream);
+}
+
+//--------------------------------------------------------------------------------------------------
+// Class BinaryLoggerOutput
+
+void BinaryLoggerOutput::write(std::vector<char>&& records)
+{
+   default_logger().write_binary(std::move(records));
+}
+
+std::shared_ptr<BinaryLoggerOutput> make_binary_logger_output()
+{
+   return std::make_shared<BinaryLoggerOutput>();
+}
+
+//--------------------------------------------------------------------------------------------------
+// Class BinaryDecoder
+
+BinaryDecoder::BinaryDecoder(RecordFunc func)
+   : _func(std::move(func))
+   , _sites()
+{
+}
+
+void BinaryDecoder::add_registered_call_sites()
+{
+   auto sites = registered_call_sites();
+
+   for (std::size_t id = _sites.size(); id < sites.size(); ++id)
+   {
+      const auto& site = sites[id];
+
+      add_call_site(static_cast<uint32_t>(id), site.level, site.file_name, site.line_number);
+   }
+}
+
+void BinaryDecoder::add_call_site(uint32_t id,
+                                  Level level,
+                                  std::string_view file_name,
+                                  int line_number)
+{
+   if (id >= _sites.size())
+      _sites.resize(id + 1);
+
+   _sites[id].level       = level;
+   _sites[id].file_name   = std::string(file_name);
+   _sites[id].line_number = line_number;
+}
+
+bool BinaryDecoder::decode_records(const char* data, std::size_t size)
+{
+   Reader reader(data, size);
+
+   while (not reader.at_end())
+   {
+      uint32_t site_id = 0;
+      int64_t ts       = 0;
+      uint8_t argc     = 0;
+
+      if (not reader.read(site_id) or not reader.read(ts) or not reader.read(argc))
+         return false;
+
+      if (site_id >= _sites.size())
+         return false;
+
+      const auto& site = _sites[site_id];
+
+      Record record(site.level, "", SourceLocation{site.file_name, site.line_number});
+
+      record.time_stamp(TimePoint<>(std::chrono::duration_cast<TimePoint<>::duration>(
+         std::chrono::nanoseconds(ts))));
+
+      for (uint8_t i = 0; i < argc; ++i)
+      {
+         if (not decode_arg(reader, record))
+            return false;
+      }
+
+      _func(std::move(record));
+   }
+   return true;
+}
+
+bool BinaryDecoder::decode(std::istream& in)
+{
+   char file_magic[4] = {};
+   uint32_t file_version = 0;
+
+   if (not in.read(file_magic, sizeof(file_magic)) or not read_value(in, file_version))
+      return false;
+
+   if (std::memcmp(file_magic, magic, sizeof(magic)) != 0 or file_version != version)
+      return false;
+
+   std::vector<char> block;
+
+   BlockKind kind{};
+
+   while (read_value(in, kind))
+   {
+      uint32_t len = 0;
+
+      if (not read_value(in, len))
+         return false;
+
+      block.resize(len);
+
+      if (not in.read(block.data(), len))
+         return false;
+
+      switch (kind)
+      {
+         case BlockKind::CallSite:
+         {
+            Reader reader(block.data(), block.size());
+
+            uint32_t id      = 0;
+            uint16_t level   = 0;
+            int32_t line     = 0;
+            std::string_view file_name;
+
+            if (not reader.read(id) or not reader.read(level) or not reader.read(line) or
+                not reader.read(file_name))
+               return false;
+
+            add_call_site(id, static_cast<Level>(level), file_name, line);
+            break;
+         }
+         case BlockKind::Records:
+            if (not decode_records(block.data(), block.size()))
+               return false;
+            break;
+         default:
+            return false;
+      }
+   }
+   return in.eof();
+}
+
+} // namespace log
+} // namespace orion
@@ -26,16 +26,17 @@ namespace log
 class EndRecord : public Record
 {
 public:
-   virtual std::string message() const override;
+   EndRecord();
 };
 
 //-------------------------------------------------------------------------------------------------
 
-std::string EndRecord::message() const
+EndRecord::EndRecord()
+   : Record(Level::NotSet, "")
 {
    auto now = std::chrono::system_clock::now();
 
-   return "\nLog End Time - " + orion::to_string(now, "%c");
+   append_message("\nLog End Time - " + orion::to_string(now, "%c"));
 }
 
 } // namespace log
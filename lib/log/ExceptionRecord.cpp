@@ -18,7 +18,7 @@ namespace log
 /*!
    Constructor
  */
-ExceptionRecord::ExceptionRecord(const std::string& msg,
+ExceptionRecord::ExceptionRecord(std::string_view msg,
                                  const SourceLocation& thrown_src_loc,
                                  const SourceLocation& caught_src_loc)
    : Record(Level::Exception, msg, thrown_src_loc)
@@ -41,6 +41,11 @@ ExceptionRecord& ExceptionRecord::operator=(ExceptionRecord&& rhs) noexcept
    return *this;
 }
 
+std::unique_ptr<Record> ExceptionRecord::detach()
+{
+   return std::make_unique<ExceptionRecord>(std::move(*this));
+}
+
 const SourceLocation& ExceptionRecord::thrown_source_location() const
 {
    return Record::source_location();
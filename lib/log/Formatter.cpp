@@ -29,7 +29,7 @@ OnelineFormatter::OnelineFormatter(bool with_src_loc /*= false*/)
 std::string OnelineFormatter::format(const Record& record)
 {
    if (record.level() == Level::NotSet)
-      return record.message();
+      return std::string{record.message()};
 
    std::string scope;
 
@@ -82,7 +82,7 @@ std::unique_ptr<OnelineFormatter> make_one_line_formatter(bool with_src_loc /*=
 std::string MultilineFormatter::format(const Record& record)
 {
    if (record.level() == Level::NotSet)
-      return record.message();
+      return std::string{record.message()};
 
    std::string scope;
 
@@ -65,6 +65,7 @@ void start(SystemInfoFunc system_info /* = DefaultInfo */)
 
 void shutdown()
 {
+   flush_binary();
    default_logger().shutdown();
 }
 
@@ -17,11 +17,24 @@ namespace orion
 {
 namespace log
 {
+namespace
+{
+/// Set while the calling thread writes the queued records
+thread_local bool this_thread_is_draining = false;
+} // namespace
 
 LoggerImpl::LoggerImpl(Level level)
    : _level(level)
    , _is_running(false)
    , _scope_depth(0)
+   , _queue(nullptr)
+   , _queues_mutex()
+   , _queues()
+   , _is_async(false)
+   , _drain_pending(false)
+   , _binary_mutex()
+   , _binary_records()
+   , _binary_decoder([this](Record&& record) { write_unlocked(record); })
 {
 }
 
@@ -62,13 +75,158 @@ void LoggerImpl::add_output_handler(std::unique_ptr<OutputHandler>&& hdl)
 
 void LoggerImpl::write(const Record& record)
 {
-   // Pass the work of writing to the background thread.
+   std::lock_guard<std::mutex> lock(_write_mutex);
+
+   write_unlocked(record);
+}
+
+bool LoggerImpl::enqueue(Record&& record)
+{
+   if (not _is_async.load(std::memory_order_acquire))
+   {
+      write(record);
+      return false;
+   }
+
+   // Pass the work of writing to the background thread. A record written by an
+   // output handler while draining cannot wait for the queue to have room.
+   auto queue = _queue.load(std::memory_order_acquire);
+
+   if (not queue->push(record.detach(), not this_thread_is_draining))
+      return false;
+
+   return not _drain_pending.exchange(true, std::memory_order_acq_rel);
+}
+
+bool LoggerImpl::enqueue_binary(std::vector<char>&& records)
+{
+   {
+      std::lock_guard<std::mutex> lock(_binary_mutex);
+
+      _binary_records.push_back(std::move(records));
+   }
+   return not _drain_pending.exchange(true, std::memory_order_acq_rel);
+}
+
+void LoggerImpl::drain()
+{
+   std::lock_guard<std::mutex> lock(_write_mutex);
+
+   // Cleared before popping so a record queued after the last pop
+   // schedules a new drain.
+   _drain_pending.store(false, std::memory_order_release);
+
+   drain_unlocked();
+}
+
+void LoggerImpl::flush()
+{
+   std::lock_guard<std::mutex> lock(_write_mutex);
+
+   drain_unlocked();
+
+   for (auto& output : _output_handlers)
+   {
+      output->flush();
+   }
+}
+
+void LoggerImpl::enable_async(std::size_t capacity, OverflowPolicy policy)
+{
+   _is_async.store(false, std::memory_order_release);
+
+   std::lock_guard<std::mutex> lock(_write_mutex);
+
+   drain_unlocked();
+
+   auto queue = std::make_unique<RecordQueue>(capacity, policy);
+
+   _queue.store(queue.get(), std::memory_order_release);
+   {
+      std::lock_guard<std::mutex> queues_lock(_queues_mutex);
+
+      _queues.push_back(std::move(queue));
+   }
+   _is_async.store(true, std::memory_order_release);
+}
+
+void LoggerImpl::disable_async()
+{
+   _is_async.store(false, std::memory_order_release);
+
+   std::lock_guard<std::mutex> lock(_write_mutex);
+
+   drain_unlocked();
+}
+
+bool LoggerImpl::is_async() const
+{
+   return _is_async.load(std::memory_order_relaxed);
+}
+
+uint64_t LoggerImpl::dropped_count() const
+{
+   std::lock_guard<std::mutex> lock(_queues_mutex);
+
+   uint64_t count = 0;
+
+   for (const auto& queue : _queues)
+      count += queue->dropped_count();
+
+   return count;
+}
+
+void LoggerImpl::write_unlocked(const Record& record)
+{
    for (auto& output : _output_handlers)
    {
       output->write(record);
    }
 }
 
+void LoggerImpl::drain_unlocked()
+{
+   this_thread_is_draining = true;
+
+   // Queues are only added, and never freed before the logger
+   for (std::size_t i = 0;; ++i)
+   {
+      RecordQueue* queue = nullptr;
+      {
+         std::lock_guard<std::mutex> lock(_queues_mutex);
+
+         if (i == _queues.size())
+            break;
+
+         queue = _queues[i].get();
+      }
+
+      while (auto record = queue->pop())
+      {
+         write_unlocked(*record);
+      }
+   }
+
+   this_thread_is_draining = false;
+
+   std::vector<std::vector<char>> binary_records;
+   {
+      std::lock_guard<std::mutex> lock(_binary_mutex);
+
+      binary_records.swap(_binary_records);
+   }
+
+   if (binary_records.empty())
+      return;
+
+   _binary_decoder.add_registered_call_sites();
+
+   for (const auto& records : binary_records)
+   {
+      _binary_decoder.decode_records(records.data(), records.size());
+   }
+}
+
 /// Starts the logging
 void LoggerImpl::start(const SystemInfoFunc& system_info)
 {
@@ -78,10 +236,20 @@ void LoggerImpl::start(const SystemInfoFunc& system_info)
 }
 
 /// Shuts down the logger
+///
+/// The queued records are written before the end record.
 void LoggerImpl::shutdown()
 {
-   write(EndRecord());
+   std::lock_guard<std::mutex> lock(_write_mutex);
+
+   drain_unlocked();
+   write_unlocked(EndRecord());
    suspend();
+
+   for (auto& output : _output_handlers)
+   {
+      output->flush();
+   }
 }
 
 /// Suspend logging
@@ -27,22 +27,24 @@ Record::Record()
 /*!
    Constructor
  */
-Record::Record(Level level, const std::string& msg)
+Record::Record(Level level, std::string_view msg)
    : _level(level)
    , _time_stamp(std::chrono::system_clock::now())
-   , _message(msg)
+   , _message()
 {
+   append_message(msg);
 }
 
 /*!
    Constructor
  */
-Record::Record(Level level, const std::string& msg, const SourceLocation& src_loc)
+Record::Record(Level level, std::string_view msg, const SourceLocation& src_loc)
    : _level(level)
    , _time_stamp(std::chrono::system_clock::now())
-   , _message(msg)
+   , _message()
    , _src_location(src_loc)
 {
+   append_message(msg);
 }
 
 Record::Record(Record&& rhs) noexcept
@@ -68,19 +70,25 @@ TimePoint<> Record::time_stamp() const
    return _time_stamp;
 }
 
-std::string Record::message() const
+void Record::time_stamp(TimePoint<> value)
 {
-   return _message.str();
+   _time_stamp = value;
 }
 
-void Record::message(const std::string& msg)
+std::string_view Record::message() const
 {
-   _message.str(msg);
+   return std::string_view(_message.data(), _message.size());
 }
 
-void Record::append_message(const std::string& text)
+void Record::message(std::string_view msg)
 {
-   _message << text;
+   _message.clear();
+   append_message(msg);
+}
+
+void Record::append_message(std::string_view text)
+{
+   _message.append(text.data(), text.data() + text.size());
 }
 
 const SourceLocation& Record::source_location() const
@@ -93,6 +101,11 @@ void Record::source_location(const SourceLocation& value)
    _src_location = value;
 }
 
+std::unique_ptr<Record> Record::detach()
+{
+   return std::make_unique<Record>(std::move(*this));
+}
+
 Record& Record::operator=(Record&& rhs) noexcept 
 {
    _level        = rhs._level;
@@ -0,0 +1,155 @@
+//
+// RecordQueue.cpp
+//
+// Copyright (c) 2013-2017 Tomas Palazuelos
+//
+// Distributed under the MIT Software License. (See accompanying file LICENSE.md)
+//
+#include <orion/log/RecordQueue.h>
+
+#include <orion/log/Record.h>
+
+#include <thread>
+
+namespace orion
+{
+namespace log
+{
+namespace
+{
+std::size_t round_up_pow2(std::size_t value)
+{
+   std::size_t n = 2;
+
+   while (n < value)
+      n <<= 1;
+
+   return n;
+}
+} // namespace
+
+RecordQueue::RecordQueue(std::size_t capacity, OverflowPolicy policy)
+   : _cells(std::make_unique<Cell[]>(round_up_pow2(capacity)))
+   , _mask(round_up_pow2(capacity) - 1)
+   , _policy(policy)
+   , _dropped_count(0)
+   , _enqueue_pos(0)
+   , _dequeue_pos(0)
+{
+   for (std::size_t i = 0; i <= _mask; ++i)
+   {
+      _cells[i].sequence.store(i, std::memory_order_relaxed);
+   }
+}
+
+RecordQueue::~RecordQueue() = default;
+
+std::size_t RecordQueue::capacity() const
+{
+   return _mask + 1;
+}
+
+OverflowPolicy RecordQueue::policy() const
+{
+   return _policy;
+}
+
+uint64_t RecordQueue::dropped_count() const
+{
+   return _dropped_count.load(std::memory_order_relaxed);
+}
+
+bool RecordQueue::push(std::unique_ptr<Record>&& record, bool can_wait /*= true*/)
+{
+   while (not try_push(record))
+   {
+      switch (_policy)
+      {
+         case OverflowPolicy::Block:
+            if (not can_wait)
+            {
+               _dropped_count.fetch_add(1, std::memory_order_relaxed);
+               return false;
+            }
+            std::this_thread::yield();
+            break;
+         case OverflowPolicy::DropNewest:
+            _dropped_count.fetch_add(1, std::memory_order_relaxed);
+            return false;
+         case OverflowPolicy::DropOldest:
+            if (pop() != nullptr)
+               _dropped_count.fetch_add(1, std::memory_order_relaxed);
+            break;
+      }
+   }
+   return true;
+}
+
+bool RecordQueue::try_push(std::unique_ptr<Record>& record)
+{
+   std::size_t pos = _enqueue_pos.load(std::memory_order_relaxed);
+   Cell* cell      = nullptr;
+
+   for (;;)
+   {
+      cell = &_cells[pos & _mask];
+
+      auto seq  = cell->sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+      if (diff == 0)
+      {
+         if (_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            break;
+      }
+      else if (diff < 0)
+      {
+         // Queue is full
+         return false;
+      }
+      else
+      {
+         pos = _enqueue_pos.load(std::memory_order_relaxed);
+      }
+   }
+
+   cell->record = std::move(record);
+   cell->sequence.store(pos + 1, std::memory_order_release);
+   return true;
+}
+
+std::unique_ptr<Record> RecordQueue::pop()
+{
+   std::size_t pos = _dequeue_pos.load(std::memory_order_relaxed);
+   Cell* cell      = nullptr;
+
+   for (;;)
+   {
+      cell = &_cells[pos & _mask];
+
+      auto seq  = cell->sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+
+      if (diff == 0)
+      {
+         if (_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            break;
+      }
+      else if (diff < 0)
+      {
+         // Queue is empty
+         return nullptr;
+      }
+      else
+      {
+         pos = _dequeue_pos.load(std::memory_order_relaxed);
+      }
+   }
+
+   auto record = std::move(cell->record);
+   cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+   return record;
+}
+
+} // namespace log
+} // namespace orion
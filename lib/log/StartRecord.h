@@ -25,16 +25,17 @@ namespace log
 class StartRecord : public Record
 {
 public:
-   virtual std::string message() const override;
+   StartRecord();
 };
 
 //-------------------------------------------------------------------------------------------------
 
-std::string StartRecord::message() const
+StartRecord::StartRecord()
+   : Record(Level::NotSet, "")
 {
    auto now = std::chrono::system_clock::now();
 
-   return "\nLog Start Time - " + orion::to_string(now, "%c");
+   append_message("\nLog Start Time - " + orion::to_string(now, "%c"));
 }
 
 } // namespace log
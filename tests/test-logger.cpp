@@ -8,10 +8,73 @@
 #include <orion/Log.h>
 #include <orion/Test.h>
 
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <thread>
+#include <vector>
+
 using namespace orion;
 using namespace orion::log;
 using namespace orion::unittest;
 
+//----------------------------------------------------------------------------
+// Allocation counter
+//----------------------------------------------------------------------------
+/// Counts the allocations made by the current thread while it is alive
+///
+/// The replaced operator new only counts when a counter is active on the
+/// calling thread, every other allocation of the test binary is forwarded
+/// untouched.
+class AllocationCounter
+{
+public:
+   AllocationCounter()
+      : _previous(active)
+   {
+      active = this;
+   }
+
+   ~AllocationCounter() { active = _previous; }
+
+   std::size_t count() const { return _count; }
+
+   static void on_allocation()
+   {
+      if (active != nullptr)
+         ++active->_count;
+   }
+
+private:
+   static thread_local AllocationCounter* active;
+
+   AllocationCounter* _previous;
+   std::size_t _count{0};
+};
+
+thread_local AllocationCounter* AllocationCounter::active = nullptr;
+
+void* operator new(std::size_t size)
+{
+   AllocationCounter::on_allocation();
+
+   if (void* p = std::malloc(size))
+      return p;
+
+   throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+   std::free(p);
+}
+
+void operator delete(void* p, std::size_t /*unused*/) noexcept
+{
+   std::free(p);
+}
+
 Record output_record;
 Logger& logger = default_logger();
 
@@ -121,10 +184,304 @@ TestCase("Log output record")
    auto sl = output_record.source_location();
 
    check_eq(Level::Message, output_record.level());
-   check_eq(std::string{"FileName"}, sl.file_name());
+   check_eq(std::string_view{"FileName"}, sl.file_name());
    check_eq(99, sl.line_number());
-   check_eq(std::string{"function name"}, sl.function_name());
+   check_eq(std::string_view{"function name"}, sl.function_name());
    check_eq(std::string{"message"}, output_record.message());
 }
 
+TestCase("Log async output record")
+{
+   logger.level(Level::NotSet);
+   logger.enable_async(64);
+
+   check_true(logger.is_async());
+
+   for (int i = 0; i < 100; i++)
+   {
+      LOG(Error) << "Async message " << i;
+   }
+
+   logger.flush();
+
+   check_eq(Level::Error, output_record.level());
+   check_eq(std::string{"Async message 99"}, output_record.message());
+   check_eq(uint64_t{0}, logger.dropped_count());
+
+   logger.disable_async();
+
+   check_false(logger.is_async());
+}
+
+TestCase("Record queue drop newest")
+{
+   RecordQueue queue(4, OverflowPolicy::DropNewest);
+
+   for (int i = 0; i < 6; i++)
+   {
+      queue.push(std::make_unique<Record>(Level::Info, std::to_string(i)));
+   }
+
+   check_eq(std::size_t{4}, queue.capacity());
+   check_eq(uint64_t{2}, queue.dropped_count());
+   check_eq(std::string{"0"}, queue.pop()->message());
+}
+
+TestCase("Record queue block without waiting")
+{
+   RecordQueue queue(2, OverflowPolicy::Block);
+
+   check_true(queue.push(std::make_unique<Record>(Level::Info, "0"), false));
+   check_true(queue.push(std::make_unique<Record>(Level::Info, "1"), false));
+   check_false(queue.push(std::make_unique<Record>(Level::Info, "2"), false));
+
+   check_eq(uint64_t{1}, queue.dropped_count());
+   check_eq(std::string{"0"}, queue.pop()->message());
+}
+
+TestCase("Record queue drop oldest")
+{
+   RecordQueue queue(4, OverflowPolicy::DropOldest);
+
+   for (int i = 0; i < 6; i++)
+   {
+      queue.push(std::make_unique<Record>(Level::Info, std::to_string(i)));
+   }
+
+   check_eq(uint64_t{2}, queue.dropped_count());
+   check_eq(std::string{"2"}, queue.pop()->message());
+   check_eq(std::string{"3"}, queue.pop()->message());
+   check_eq(std::string{"4"}, queue.pop()->message());
+   check_eq(std::string{"5"}, queue.pop()->message());
+   check_true(queue.pop() == nullptr);
+}
+
+TestCase("Record short message does not allocate")
+{
+   logger.level(Level::Info);
+
+   // The first record may set up the output
+   LOG(Info) << "Warm up";
+
+   std::size_t allocations = 0;
+   {
+      AllocationCounter counter;
+
+      LOG(Info) << "Short message, value " << 42 << ", ratio " << 0.5 << ", char " << 'c';
+
+      allocations = counter.count();
+   }
+
+   check_eq(std::size_t{0}, allocations);
+   check_eq(std::string_view{"Short message, value 42, ratio 0.5, char c"},
+            output_record.message());
+   check_eq(std::string_view{__FILE__}, output_record.source_location().file_name());
+}
+
+TestCase("Record message view")
+{
+   Record record(Level::Info, "Value ");
+
+   record << 42;
+
+   check_eq(std::string_view{"Value 42"}, record.message());
+}
+
+TestCase("Record long message")
+{
+   std::string text(Record::inline_size * 2, 'x');
+
+   Record record(Level::Info, text);
+
+   record << "y";
+
+   check_eq(text.size() + 1, record.message().size());
+   check_eq('y', record.message().back());
+}
+
+TestCase("Binary log round trip")
+{
+   std::stringstream stream;
+
+   set_binary_output(make_binary_stream_output(stream));
+
+   logger.level(Level::NotSet);
+
+   int line = __LINE__ + 1;
+   LOG_DEFERRED(Warning, "Deferred ", 42, ' ', 1.5, " ", std::string{"text"});
+
+   flush_binary();
+   set_binary_output(nullptr);
+
+   std::vector<Record> records;
+
+   BinaryDecoder decoder([&](Record&& record) { records.push_back(std::move(record)); });
+
+   check_true(decoder.decode(stream));
+   check_eq(std::size_t{1}, records.size());
+   check_eq(Level::Warning, records[0].level());
+   check_eq(std::string_view{"Deferred 42 1.5 text"}, records[0].message());
+   check_eq(line, records[0].source_location().line_number());
+}
+
+TestCase("Binary log flush of other threads")
+{
+   std::stringstream stream;
+
+   set_binary_output(make_binary_stream_output(stream));
+
+   logger.level(Level::NotSet);
+
+   std::atomic<bool> logged{false};
+   std::atomic<bool> flushed{false};
+
+   // The thread stays alive, so its records are only written by the flush
+   std::thread thread([&] {
+      LOG_DEFERRED(Info, "From another thread ", 7);
+      logged = true;
+
+      while (not flushed)
+         std::this_thread::yield();
+   });
+
+   while (not logged)
+      std::this_thread::yield();
+
+   flush_binary();
+   set_binary_output(nullptr);
+
+   flushed = true;
+   thread.join();
+
+   std::vector<Record> records;
+
+   BinaryDecoder decoder([&](Record&& record) { records.push_back(std::move(record)); });
+
+   check_true(decoder.decode(stream));
+   check_eq(std::size_t{1}, records.size());
+   check_eq(std::string_view{"From another thread 7"}, records[0].message());
+}
+
+TestCase("Binary decoder keeps call site names")
+{
+   std::vector<Record> records;
+
+   BinaryDecoder decoder([&](Record&& record) { records.push_back(std::move(record)); });
+
+   decoder.add_call_site(0, Level::Info, "a.cpp", 10);
+
+   std::vector<char> data;
+   log::detail::put(data, uint32_t{0});
+   log::detail::put(data, int64_t{0});
+   log::detail::put(data, uint8_t{0});
+
+   check_true(decoder.decode_records(data.data(), data.size()));
+
+   // Short names are stored inline, growing the sites must not move them
+   for (uint32_t id = 1; id < 100; ++id)
+      decoder.add_call_site(id, Level::Info, "b.cpp", 20);
+
+   check_eq(std::size_t{1}, records.size());
+   check_eq(std::string_view{"a.cpp"}, records[0].source_location().file_name());
+}
+
+
+/// Output handler writing more records to the logger, as a handler logging its errors does
+class ReentrantOutputHandler : public OutputHandler
+{
+public:
+   NO_COPY(ReentrantOutputHandler)
+   NO_MOVE(ReentrantOutputHandler)
+
+   explicit ReentrantOutputHandler(LoggerImpl& impl)
+      : _impl(impl)
+   {
+   }
+
+   ~ReentrantOutputHandler() override = default;
+
+   void write(const Record& record) override
+   {
+      ++record_count;
+
+      if (record.message() != "outer")
+         return;
+
+      for (int i = 0; i < 4; i++)
+         _impl.enqueue(Record(Level::Error, "inner"));
+   }
+
+   void flush() override {}
+
+   void close() override {}
+
+   int record_count{0};
+
+private:
+   LoggerImpl& _impl;
+};
+
+TestCase("Async logging from an output handler")
+{
+   LoggerImpl impl(Level::NotSet);
+
+   auto handler = std::make_unique<ReentrantOutputHandler>(impl);
+   auto* counts = handler.get();
+
+   impl.add_output_handler(std::move(handler));
+   impl.resume();
+   impl.enable_async(2, OverflowPolicy::Block);
+
+   impl.enqueue(Record(Level::Info, "outer"));
+   impl.enqueue(Record(Level::Info, "outer"));
+
+   // The queue is full while the handler writes, the records it cannot queue are dropped
+   impl.drain();
+
+   check_true(impl.dropped_count() > 0);
+   check_eq(uint64_t{10}, counts->record_count + impl.dropped_count());
+}
+
+TestCase("Async logging while the queue is replaced")
+{
+   LoggerImpl impl(Level::NotSet);
+
+   auto handler = std::make_unique<ReentrantOutputHandler>(impl);
+   auto* counts = handler.get();
+
+   impl.add_output_handler(std::move(handler));
+   impl.resume();
+   impl.enable_async(1024, OverflowPolicy::DropNewest);
+
+   const int thread_count = 4;
+   const int iterations   = 2000;
+
+   std::atomic<int> running{thread_count};
+
+   std::vector<std::thread> threads;
+
+   for (int t = 0; t < thread_count; t++)
+   {
+      threads.emplace_back([&] {
+         for (int i = 0; i < iterations; i++)
+            impl.enqueue(Record(Level::Info, "0"));
+
+         --running;
+      });
+   }
+
+   while (running > 0)
+   {
+      impl.enable_async(1024, OverflowPolicy::DropNewest);
+      impl.drain();
+   }
+
+   for (auto& thread : threads)
+      thread.join();
+
+   impl.drain();
+
+   check_eq(uint64_t{thread_count * iterations}, counts->record_count + impl.dropped_count());
+}
+
 } // TestSuite(OrionCore_Logger)
@@ -0,0 +1,70 @@
+//
+// orion-logdecode.cpp
+//
+// Copyright (c) 2013-2017 Tomas Palazuelos
+//
+// Distributed under the MIT Software License. (See accompanying file LICENSE.md)
+//
+#include <orion/Log.h>
+
+#include <clara/clara.hpp>
+
+#include <fstream>
+#include <iostream>
+
+using namespace orion;
+
+bool parse_cmd_options(int argc, char* argv[], std::string& file_name, bool& with_src_loc)
+{
+   using namespace clara;
+
+   bool show_help = false;
+
+   auto options = Help(show_help)
+                | Opt(with_src_loc)["-s"]["--source-location"]("print the source location")
+                | Arg(file_name, "file")("binary log file to decode"); 
+
+   auto result = options.parse(Args(argc, argv));
+   if (not result)
+   {
+      std::cerr << "Error: \n" << result.errorMessage() << "\n";
+      return false;
+   }
+   if (show_help or file_name.empty())
+   {
+      options.writeToStream(std::cout);
+      return false;
+   }
+   return true;
+}
+
+int main(int argc, char* argv[])
+{
+   std::string file_name;
+   bool with_src_loc = false;
+
+   if (not parse_cmd_options(argc, argv, file_name, with_src_loc))
+      return EXIT_FAILURE;
+
+   std::ifstream in(file_name, std::ios::binary);
+
+   if (not in)
+   {
+      std::cerr << "Error: cannot open " << file_name << "\n";
+      return EXIT_FAILURE;
+   }
+
+   log::OnelineFormatter formatter(with_src_loc);
+
+   log::BinaryDecoder decoder([&](log::Record&& record) {
+      std::cout << formatter.format(record) << "\n";
+   });
+
+   if (not decoder.decode(in))
+   {
+      std::cerr << "Error: " << file_name << " is not a valid binary log\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}